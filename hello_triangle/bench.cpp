@@ -0,0 +1,282 @@
+// CPU microbenchmarks for the hot paths that keep coming up in review:
+// vertex hashing and dedup, vertex packing, the per-frame GLM matrix work,
+// the particle pool init and file load throughput. Build the `bench` target
+// and run:
+//
+//     ./bench [--csv bench.csv]
+//
+// Each benchmark reports the fastest pass, so the numbers are comparable
+// across runs; pass `--csv` to also write machine-readable rows for CI
+// tracking, like the renderer's own benchmark mode does.
+#define MICROBENCH_BUILD
+#include "main.cpp"
+
+#include <cstdio>
+#include <random>
+
+namespace {
+
+// Every benchmark keeps re-running its workload until this much time has
+// passed, so one-off scheduler noise doesn't decide the reported number.
+constexpr double MIN_RUN_SECONDS = 0.5;
+
+// Sized like a mid-weight OBJ import: many more stream entries than unique
+// vertices, so the dedup table sees plenty of hits.
+constexpr size_t UNIQUE_VERTEX_COUNT = 100'000;
+constexpr size_t VERTEX_STREAM_LENGTH = 600'000;
+
+constexpr uint32_t BENCH_PARTICLE_COUNT = 65'536;
+
+constexpr const char* SCRATCH_PATH = "bench_scratch.bin";
+constexpr size_t SCRATCH_SIZE = 64 * 1024 * 1024;
+
+// Accumulating results into a volatile keeps the optimizer from deleting
+// the benchmarked loops outright.
+volatile uint64_t gSink = 0;
+
+struct BenchResult {
+    std::string name;
+    double nsPerItem = 0.0;
+    double itemsPerSecond = 0.0;
+};
+
+std::vector<BenchResult> gResults;
+
+// Runs `pWork` (which processes `pItems` of `pUnit` per call) until
+// `MIN_RUN_SECONDS` have elapsed and records the fastest pass. The first
+// call is a warm-up, so page faults and allocations stay out of the timings.
+template <typename Work>
+void runBenchmark(const char* pName, uint64_t pItems, const char* pUnit, Work&& pWork)
+{
+    pWork();
+
+    double bestSeconds = std::numeric_limits<double>::max();
+    double totalSeconds = 0.0;
+    while (totalSeconds < MIN_RUN_SECONDS) {
+        const auto start = std::chrono::steady_clock::now();
+        pWork();
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        bestSeconds = std::min(bestSeconds, seconds);
+        totalSeconds += seconds;
+    }
+
+    const double nsPerItem = bestSeconds * 1e9 / (double)pItems;
+    const double itemsPerSecond = (double)pItems / bestSeconds;
+    gResults.push_back({ pName, nsPerItem, itemsPerSecond });
+
+    std::cout << pName << ": " << nsPerItem << " ns per " << pUnit
+              << " (" << itemsPerSecond / 1e6 << " million " << pUnit << "s/s)\n";
+}
+
+// Synthetic vertex soup shaped like an OBJ index stream.
+std::vector<Vertex> makeVertexStream()
+{
+    std::default_random_engine engine(12345);
+    std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+
+    std::vector<Vertex> unique(UNIQUE_VERTEX_COUNT);
+    for (Vertex& vertex : unique) {
+        vertex.position = { distribution(engine), distribution(engine), distribution(engine) };
+        vertex.color = { 1.0f, 1.0f, 1.0f };
+        vertex.texCoord = { distribution(engine), distribution(engine) };
+    }
+
+    std::vector<Vertex> stream(VERTEX_STREAM_LENGTH);
+    std::uniform_int_distribution<size_t> pick(0, UNIQUE_VERTEX_COUNT - 1);
+    for (Vertex& vertex : stream) {
+        vertex = unique[pick(engine)];
+    }
+
+    return stream;
+}
+
+void benchVertexHash(const std::vector<Vertex>& pStream)
+{
+    runBenchmark("vertex_hash", pStream.size(), "vertex", [&] {
+        uint64_t sum = 0;
+        for (const Vertex& vertex : pStream) {
+            sum += hashVertex(vertex);
+        }
+        gSink += sum;
+    });
+}
+
+// Mirrors the dedup loop in `loadModel()`: one `findOrInsert()` per stream
+// entry against a table sized for the whole stream.
+void benchVertexDedup(const std::vector<Vertex>& pStream)
+{
+    runBenchmark("vertex_dedup", pStream.size(), "vertex", [&] {
+        VertexDedupTable table(pStream.size());
+        std::vector<Vertex> vertices;
+        vertices.reserve(UNIQUE_VERTEX_COUNT);
+
+        uint64_t sum = 0;
+        for (const Vertex& vertex : pStream) {
+            sum += table.findOrInsert(vertex, vertices);
+        }
+        gSink += sum;
+    });
+}
+
+// Mirrors the packing loop in `createVertexBuffer()`: half-float positions
+// and unorm texture coordinates.
+void benchVertexPacking(const std::vector<Vertex>& pStream)
+{
+    std::vector<PackedVertex> packed(pStream.size());
+    runBenchmark("vertex_packing", pStream.size(), "vertex", [&] {
+        for (size_t i = 0; i < pStream.size(); i += 1) {
+            packed[i] = PackedVertex(pStream[i]);
+        }
+        gSink += packed.back().position[0];
+    });
+}
+
+// Mirrors the per-frame CPU matrix work in `updateUniformBuffer()`: the
+// model/view/projection build plus the Gribb/Hartmann frustum extraction
+// for the culling pass.
+void benchUniformUpdate()
+{
+    constexpr uint64_t FRAMES_PER_RUN = 100'000;
+    runBenchmark("uniform_update", FRAMES_PER_RUN, "frame", [&] {
+        float accumulator = 0.0f;
+        for (uint64_t frame = 0; frame < FRAMES_PER_RUN; frame += 1) {
+            const float time = (float)frame * 0.016f;
+            const glm::mat4 model = glm::rotate(glm::mat4(1.0f), glm::radians(45.0f * std::sin(time)), glm::vec3(0.0f, 0.0f, 1.0f));
+            const glm::mat4 view = glm::lookAt(glm::vec3(2.0f, 2.0f, 2.0f), glm::vec3(0.0f, 0.0f, 0.0f), glm::vec3(0.0f, 0.0f, 1.0f));
+            glm::mat4 projection = glm::perspective(glm::radians(45.0f), WINDOW_WIDTH / (float)WINDOW_HEIGHT, 0.01f, 10.0f);
+            projection[1][1] *= -1.0f;
+
+            const glm::mat4 viewProjection = projection * view * model;
+            glm::vec4 rows[4];
+            for (int i = 0; i < 4; i += 1) {
+                rows[i] = glm::vec4(viewProjection[0][i], viewProjection[1][i], viewProjection[2][i], viewProjection[3][i]);
+            }
+
+            glm::vec4 planes[6];
+            planes[0] = rows[3] + rows[0];
+            planes[1] = rows[3] - rows[0];
+            planes[2] = rows[3] + rows[1];
+            planes[3] = rows[3] - rows[1];
+            planes[4] = rows[2];
+            planes[5] = rows[3] - rows[2];
+            for (glm::vec4& plane : planes) {
+                plane /= glm::length(glm::vec3(plane));
+            }
+
+            accumulator += planes[0].x + planes[5].w;
+        }
+        gSink += (uint64_t)(int64_t)(accumulator * 1000.0f);
+    });
+}
+
+// CPU reference for the particle pool init that now runs on the GPU in
+// particle_init.comp: positions on a disc, outward velocities, random
+// colors. Benchmarked so the recurring "move it back to the CPU" debate
+// comes with numbers.
+void benchParticleInit()
+{
+    std::vector<glm::vec4> pool(BENCH_PARTICLE_COUNT * 2);
+    runBenchmark("particle_init", BENCH_PARTICLE_COUNT, "particle", [&] {
+        std::default_random_engine engine(67890);
+        std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+
+        for (uint32_t i = 0; i < BENCH_PARTICLE_COUNT; i += 1) {
+            const float r = 0.25f * std::sqrt(distribution(engine));
+            const float theta = distribution(engine) * 2.0f * 3.1415926535f;
+            const float x = r * std::cos(theta) * (WINDOW_HEIGHT / (float)WINDOW_WIDTH);
+            const float y = r * std::sin(theta);
+
+            const glm::vec2 velocity = glm::normalize(glm::vec2(x, y)) * 0.00025f;
+            pool[i * 2] = glm::vec4(x, y, velocity.x, velocity.y);
+            pool[i * 2 + 1] = glm::vec4(distribution(engine), distribution(engine), distribution(engine), 1.0f);
+        }
+        gSink += (uint64_t)(int64_t)(pool.back().x * 1000.0f);
+    });
+}
+
+// Mapped versus stream-copied reads over a scratch file, per byte. With a
+// warm page cache the interesting number is the gap between the two, which
+// is what `MappedFile` exists to remove.
+void benchFileThroughput()
+{
+    {
+        std::ofstream scratchFile(SCRATCH_PATH, std::ios::binary | std::ios::trunc);
+        if (!scratchFile.is_open()) {
+            std::cerr << "Skipping file benchmarks: couldn't write " << SCRATCH_PATH << ".\n";
+            return;
+        }
+
+        std::vector<char> chunk(1024 * 1024, 0x5A);
+        for (size_t written = 0; written < SCRATCH_SIZE; written += chunk.size()) {
+            scratchFile.write(chunk.data(), chunk.size());
+        }
+    }
+
+    runBenchmark("file_mapped_read", SCRATCH_SIZE, "byte", [&] {
+        const MappedFile file(SCRATCH_PATH);
+        const uint64_t* words = reinterpret_cast<const uint64_t*>(file.data());
+
+        uint64_t sum = 0;
+        for (size_t i = 0; i < file.size() / sizeof(uint64_t); i += 1) {
+            sum += words[i];
+        }
+        gSink += sum;
+    });
+
+    runBenchmark("file_stream_read", SCRATCH_SIZE, "byte", [&] {
+        std::ifstream file(SCRATCH_PATH, std::ios::ate | std::ios::binary);
+        std::vector<char> contents((size_t)file.tellg());
+        file.seekg(0);
+        file.read(contents.data(), contents.size());
+
+        const uint64_t* words = reinterpret_cast<const uint64_t*>(contents.data());
+        uint64_t sum = 0;
+        for (size_t i = 0; i < contents.size() / sizeof(uint64_t); i += 1) {
+            sum += words[i];
+        }
+        gSink += sum;
+    });
+
+    std::remove(SCRATCH_PATH);
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    std::string csvPath;
+    for (int i = 1; i < argc; i += 1) {
+        const std::string argument = argv[i];
+        if (argument == "--csv" && i + 1 < argc) {
+            i += 1;
+            csvPath = argv[i];
+        } else {
+            std::cerr << "Ignoring unknown command-line argument: " << argument << "\n";
+        }
+    }
+
+    const std::vector<Vertex> stream = makeVertexStream();
+    benchVertexHash(stream);
+    benchVertexDedup(stream);
+    benchVertexPacking(stream);
+    benchUniformUpdate();
+    benchParticleInit();
+    benchFileThroughput();
+
+    if (!csvPath.empty()) {
+        std::ofstream csvFile(csvPath, std::ios::trunc);
+        if (!csvFile.is_open()) {
+            std::cerr << "Couldn't write benchmark results to " << csvPath << ".\n";
+            return EXIT_FAILURE;
+        }
+
+        csvFile << "benchmark,ns_per_item,items_per_second\n";
+        for (const BenchResult& result : gResults) {
+            csvFile << result.name << "," << result.nsPerItem << "," << result.itemsPerSecond << "\n";
+        }
+        std::cout << "Benchmark results written to " << csvPath << ".\n";
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -1,13 +1,21 @@
 #version 450
+#extension GL_EXT_nonuniform_qualifier : enable
 
 layout(location = 0) in vec3 fragColor;
 layout(location = 1) in vec2 fragTexCoord;
 
-layout(binding = 1) uniform sampler2D uTexSampler;
+// Bindless: every material's texture lives in one array bound once per
+// frame; the push constant picks this draw's slot. `nonuniformEXT` marks
+// the index as potentially divergent across the invocation group.
+layout(binding = 1) uniform sampler2D uTextures[];
+
+layout(push_constant) uniform PushConstants {
+    uint materialIndex;
+} pc;
 
 layout(location = 0) out vec4 outColor;
 
 void main()
 {
-    outColor = vec4(fragColor * texture(uTexSampler, fragTexCoord).rgb, 1.0);
+    outColor = vec4(fragColor * texture(uTextures[nonuniformEXT(pc.materialIndex)], fragTexCoord).rgb, 1.0);
 }
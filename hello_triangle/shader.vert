@@ -6,16 +6,25 @@ layout(binding = 0) uniform UniformBufferObject {
     mat4 projection;
 } ubo;
 
-layout(location = 0) in vec3 inPosition;
-layout(location = 1) in vec3 inColor;
-layout(location = 2) in vec2 inTexCoord;
+// One static transform per instance, indexed with `gl_InstanceIndex`.
+layout(std140, binding = 2) readonly buffer InstanceSSBO {
+    mat4 transforms[];
+};
+
+// Positions arrive as 16-bit halves and texture coordinates as 16-bit unorm
+// (see `PackedVertex`); the fixed-function fetch expands both to floats.
+layout(location = 0) in vec4 inPosition;
+layout(location = 1) in vec2 inTexCoord;
 
 layout(location = 0) out vec3 fragColor;
 layout(location = 1) out vec2 fragTexCoord;
 
 void main()
 {
-    gl_Position = ubo.projection * ubo.view * ubo.model * vec4(inPosition, 1.0);
-    fragColor = inColor;
+    // The animated model matrix applies on top of the per-instance placement.
+    gl_Position = ubo.projection * ubo.view * ubo.model * transforms[gl_InstanceIndex] * vec4(inPosition.xyz, 1.0);
+    // The color attribute was dropped from the vertex layout; the model only
+    // ever used white.
+    fragColor = vec3(1.0);
     fragTexCoord = inTexCoord;
 }
@@ -0,0 +1,39 @@
+#!/usr/bin/env python3
+"""Converts a SPIR-V binary into a C++ header holding a constexpr array.
+
+Usage: spv_to_header.py <input.spv> <output.h> <ARRAY_NAME>
+
+Used by the shader build steps in meson.build so the SPIR-V bytecode is
+embedded into the executable instead of being read from disk at startup.
+"""
+
+import sys
+
+
+def main():
+    input_path, output_path, array_name = sys.argv[1], sys.argv[2], sys.argv[3]
+
+    with open(input_path, "rb") as input_file:
+        data = input_file.read()
+
+    if len(data) % 4 != 0:
+        sys.exit(f"{input_path} is not a valid SPIR-V binary (size not a multiple of 4).")
+
+    words = [
+        int.from_bytes(data[offset : offset + 4], "little")
+        for offset in range(0, len(data), 4)
+    ]
+
+    with open(output_path, "w") as output_file:
+        output_file.write("// Generated by spv_to_header.py. Do not edit.\n")
+        output_file.write("#pragma once\n\n")
+        output_file.write("#include <cstdint>\n\n")
+        output_file.write(f"constexpr uint32_t {array_name}[] = {{\n")
+        for offset in range(0, len(words), 8):
+            row = ", ".join(f"0x{word:08x}" for word in words[offset : offset + 8])
+            output_file.write(f"    {row},\n")
+        output_file.write("};\n")
+
+
+if __name__ == "__main__":
+    main()